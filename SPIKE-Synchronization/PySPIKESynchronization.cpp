@@ -0,0 +1,533 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "SPIKESynchronization.h"
+
+// Libraries used for the data types exchanged with the engine.
+#include <vector>
+#include <map>
+
+// Used to catch the allocation failures of the engine.
+#include <new>
+
+using namespace std;
+
+/* Python extension module exposing the SPIKESynchronization API.
+ *
+ * The spike trains are read directly from any object exporting the buffer protocol (NumPy arrays,
+ * array.array, memoryview...), so no intermediate Python lists are ever built. The computation runs
+ * with the GIL released, and the resulting profiles are returned as NumPy arrays wrapping the buffers
+ * produced by the engine, without copying them. */
+
+
+
+/*******************************************************************************************************************************/
+/* Buffer owning the output of the engine, exported to NumPy through the buffer protocol.                                     */
+/*******************************************************************************************************************************/
+
+typedef struct
+{
+    PyObject_HEAD
+    vector<double> *data;
+    Py_ssize_t shape[1];
+    Py_ssize_t strides[1];
+} ProfileBufferObject;
+
+static PyTypeObject ProfileBufferType = { PyVarObject_HEAD_INIT(NULL, 0) };
+
+// Reference to numpy.asarray, imported the first time an array is returned.
+static PyObject *numpyAsArray = NULL;
+
+static void ProfileBuffer_dealloc(ProfileBufferObject *self)
+{
+    delete self->data;
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static int ProfileBuffer_getbuffer(ProfileBufferObject *self, Py_buffer *view, int flags)
+{
+    view->obj = (PyObject *) self;
+    view->buf = self->data->data();
+    view->len = self->shape[0] * sizeof(double);
+    view->readonly = 0;
+    view->itemsize = sizeof(double);
+    view->format = (flags & PyBUF_FORMAT) ? (char *) "d" : NULL;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+
+    Py_INCREF(self);
+
+    return 0;
+}
+
+static PyBufferProcs ProfileBuffer_as_buffer = { (getbufferproc) ProfileBuffer_getbuffer, NULL };
+
+// Wrap a vector produced by the engine into a NumPy array, taking ownership of its memory.
+// Return NULL (with the Python error set) on failure.
+static PyObject *toNumPyArray(vector<double> &&values)
+{
+    if (numpyAsArray == NULL)
+    {
+        PyObject *numpy = PyImport_ImportModule("numpy");
+        if (numpy == NULL)
+            return NULL;
+
+        numpyAsArray = PyObject_GetAttrString(numpy, "asarray");
+        Py_DECREF(numpy);
+
+        if (numpyAsArray == NULL)
+            return NULL;
+    }
+
+    ProfileBufferObject *buffer = PyObject_New(ProfileBufferObject, &ProfileBufferType);
+    if (buffer == NULL)
+        return NULL;
+
+    try
+    {
+        buffer->data = new vector<double>(std::move(values));
+    }
+    catch (const bad_alloc &)
+    {
+        buffer->data = NULL;
+        PyObject_Del(buffer);
+        return PyErr_NoMemory();
+    }
+
+    buffer->shape[0] = buffer->data->size();
+    buffer->strides[0] = sizeof(double);
+
+    // The array keeps a reference to the buffer, which frees the vector when the array is collected.
+    PyObject *array = PyObject_CallFunctionObjArgs(numpyAsArray, (PyObject *) buffer, NULL);
+    Py_DECREF(buffer);
+
+    return array;
+}
+
+/*******************************************************************************************************************************/
+
+
+
+/*******************************************************************************************************************************/
+/* Input handling.                                                                                                             */
+/*******************************************************************************************************************************/
+
+// Views on the input buffers, released when going out of scope (the GIL must be held at that time).
+class BufferViews
+{
+    public:
+
+        vector<Py_buffer> views;
+
+        ~BufferViews()
+        {
+            for (size_t n = 0; n < views.size(); ++n)
+            {
+                PyBuffer_Release(&views[n]);
+            }
+        }
+};
+
+// Check if the format of the buffer matches one of the provided native type codes with the expected item size.
+static bool hasFormat(const Py_buffer &view, const char *typeCodes, Py_ssize_t itemSize)
+{
+    const char *format = view.format != NULL ? view.format : "B";
+
+    // Skip the byte order prefix, as long as it refers to the native one.
+    if (*format == '@' || *format == '=' || (PY_LITTLE_ENDIAN && *format == '<') || (!PY_LITTLE_ENDIAN && *format == '>'))
+        ++format;
+
+    if (format[0] == '\0' || format[1] != '\0' || view.itemsize != itemSize)
+        return false;
+
+    for (const char *code = typeCodes; *code != '\0'; ++code)
+    {
+        if (*code == format[0])
+            return true;
+    }
+
+    return false;
+}
+
+// Get a view on a single spike train, which must be a one-dimensional buffer of the expected type.
+// Return false (with the Python error set) on failure.
+static bool getTrainView(PyObject *object, Py_buffer *view, const char *typeCodes, Py_ssize_t itemSize, const char *typeName)
+{
+    if (PyObject_GetBuffer(object, view, PyBUF_RECORDS_RO) != 0)
+    {
+        // Objects not supporting the buffer protocol get the same message as buffers of the wrong type.
+        if (PyErr_ExceptionMatches(PyExc_TypeError))
+            PyErr_Format(PyExc_TypeError, "spike trains must be one-dimensional %s buffers", typeName);
+
+        return false;
+    }
+
+    if (view->ndim != 1 || !hasFormat(*view, typeCodes, itemSize))
+    {
+        PyErr_Format(PyExc_TypeError, "spike trains must be one-dimensional %s buffers", typeName);
+        PyBuffer_Release(view);
+        return false;
+    }
+
+    return true;
+}
+
+// Get a view on every spike train in input. The trains are either the rows of a two-dimensional buffer
+// or the elements of a sequence of one-dimensional buffers. Return false (with the Python error set) on failure.
+static bool getTrainViews(PyObject *trains, BufferViews &trainViews, const char *typeCodes, Py_ssize_t itemSize, const char *typeName)
+{
+    // A two-dimensional buffer is kept as a single view and split into rows when reading it.
+    if (PyObject_CheckBuffer(trains))
+    {
+        Py_buffer view;
+        if (PyObject_GetBuffer(trains, &view, PyBUF_RECORDS_RO) != 0)
+            return false;
+
+        if (view.ndim != 2 || !hasFormat(view, typeCodes, itemSize))
+        {
+            PyErr_Format(PyExc_TypeError, "spike trains must be a two-dimensional %s buffer", typeName);
+            PyBuffer_Release(&view);
+            return false;
+        }
+
+        trainViews.views.push_back(view);
+
+        if (view.shape[0] < 2)
+        {
+            PyErr_SetString(PyExc_ValueError, "at least two spike trains are required");
+            return false;
+        }
+
+        return true;
+    }
+
+    PyObject *sequence = PySequence_Fast(trains, "spike trains must be a sequence or a two-dimensional buffer");
+    if (sequence == NULL)
+        return false;
+
+    Py_ssize_t trainsCount = PySequence_Fast_GET_SIZE(sequence);
+    trainViews.views.reserve(trainsCount);
+
+    for (Py_ssize_t n = 0; n < trainsCount; ++n)
+    {
+        Py_buffer view;
+        if (!getTrainView(PySequence_Fast_GET_ITEM(sequence, n), &view, typeCodes, itemSize, typeName))
+        {
+            Py_DECREF(sequence);
+            return false;
+        }
+
+        trainViews.views.push_back(view);
+    }
+
+    Py_DECREF(sequence);
+
+    if (trainsCount < 2)
+    {
+        PyErr_SetString(PyExc_ValueError, "at least two spike trains are required");
+        return false;
+    }
+
+    return true;
+}
+
+// Read a spike train containing 1 where spikes occur, -1 otherwise (no GIL required).
+// The spike test is done on the int64 value, so values outside the range of int are never mistaken for spikes.
+static bool readTrain(const char *data, Py_ssize_t length, Py_ssize_t stride, vector<int> &train)
+{
+    train.resize(length);
+
+    for (Py_ssize_t n = 0; n < length; ++n)
+    {
+        train[n] = (*(const long long *) (data + n * stride) == 1) ? 1 : -1;
+    }
+
+    return true;
+}
+
+// Read a spike train containing the times at which the spikes occur (no GIL required).
+// Return false if a time is NaN or the times are not sorted in ascending order.
+static bool readTrain(const char *data, Py_ssize_t length, Py_ssize_t stride, vector<double> &train)
+{
+    train.resize(length);
+
+    for (Py_ssize_t n = 0; n < length; ++n)
+    {
+        double time = *(const double *) (data + n * stride);
+
+        // NaN fails every comparison, so it is rejected together with the unsorted times.
+        if (!(time == time) || (n > 0 && !(time >= train[n - 1])))
+            return false;
+
+        train[n] = time;
+    }
+
+    return true;
+}
+
+// Read all the spike trains from their views (no GIL required).
+// Return false if any of the trains is not valid.
+template <typename TargetType>
+static bool readTrains(const BufferViews &trainViews, vector<vector<TargetType>> &trains)
+{
+    const Py_buffer &first = trainViews.views[0];
+
+    if (first.ndim == 2)
+    {
+        trains.resize(first.shape[0]);
+
+        for (Py_ssize_t n = 0; n < first.shape[0]; ++n)
+        {
+            if (!readTrain((const char *) first.buf + n * first.strides[0], first.shape[1], first.strides[1], trains[n]))
+                return false;
+        }
+    }
+    else
+    {
+        trains.resize(trainViews.views.size());
+
+        for (size_t n = 0; n < trainViews.views.size(); ++n)
+        {
+            const Py_buffer &view = trainViews.views[n];
+            if (!readTrain((const char *) view.buf, view.shape[0], view.strides[0], trains[n]))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Read the strided elements of a profile buffer (no GIL required).
+static void readProfile(const char *data, Py_ssize_t length, Py_ssize_t stride, vector<double> &profile)
+{
+    profile.resize(length);
+
+    for (Py_ssize_t n = 0; n < length; ++n)
+    {
+        profile[n] = *(const double *) (data + n * stride);
+    }
+}
+
+/*******************************************************************************************************************************/
+
+
+
+/*******************************************************************************************************************************/
+/* Module functions.                                                                                                           */
+/*******************************************************************************************************************************/
+
+PyDoc_STRVAR(profile_doc,
+"profile(trains)\n"
+"\n"
+"Compute the SPIKE-Synchronization profile of spike trains given as int64 vectors\n"
+"containing 1 where spikes occur, -1 otherwise. The trains are either the rows of a\n"
+"two-dimensional array or a sequence of one-dimensional arrays. Return a float64 array.");
+
+static PyObject *spikesync_profile(PyObject *module, PyObject *trains)
+{
+    BufferViews trainViews;
+    if (!getTrainViews(trains, trainViews, "ql", 8, "int64"))
+        return NULL;
+
+    vector<double> synchronizationProfile;
+    bool outOfMemory = false;
+
+    Py_BEGIN_ALLOW_THREADS
+    try
+    {
+        vector<vector<int>> inputTrainsVector;
+        readTrains(trainViews, inputTrainsVector);
+
+        SPIKESynchronization spike;
+        synchronizationProfile = spike.MergeCoincidencesMultivariate(spike.CoincidenceVectorMultivariate(inputTrainsVector));
+    }
+    catch (const bad_alloc &)
+    {
+        outOfMemory = true;
+    }
+    Py_END_ALLOW_THREADS
+
+    if (outOfMemory)
+        return PyErr_NoMemory();
+
+    return toNumPyArray(std::move(synchronizationProfile));
+}
+
+PyDoc_STRVAR(profile_time_doc,
+"profile_time(trains)\n"
+"\n"
+"Compute the SPIKE-Synchronization profile of spike trains given as float64 vectors\n"
+"containing the times at which the spikes occur, sorted in ascending order (NaN is not\n"
+"allowed). The trains are either the rows of a two-dimensional array or a sequence of\n"
+"one-dimensional arrays.\n"
+"Return a (times, values) tuple of float64 arrays.");
+
+static PyObject *spikesync_profile_time(PyObject *module, PyObject *trains)
+{
+    BufferViews trainViews;
+    if (!getTrainViews(trains, trainViews, "d", 8, "float64"))
+        return NULL;
+
+    vector<double> profileTimes;
+    vector<double> profileValues;
+    bool outOfMemory = false;
+    bool invalidTrains = false;
+
+    Py_BEGIN_ALLOW_THREADS
+    try
+    {
+        vector<vector<double>> inputTrainsTime;
+        if (!readTrains(trainViews, inputTrainsTime))
+        {
+            invalidTrains = true;
+        }
+        else
+        {
+            SPIKESynchronization spike;
+            map<double, double> synchronizationProfileTime = spike.MergeCoincidencesMultivariate(spike.CoincidenceVectorMultivariate(inputTrainsTime));
+
+            // The profile is split into two contiguous vectors, ordered by time.
+            profileTimes.reserve(synchronizationProfileTime.size());
+            profileValues.reserve(synchronizationProfileTime.size());
+
+            for (auto const &timeSpikePair : synchronizationProfileTime)
+            {
+                profileTimes.push_back(timeSpikePair.first);
+                profileValues.push_back(timeSpikePair.second);
+            }
+        }
+    }
+    catch (const bad_alloc &)
+    {
+        outOfMemory = true;
+    }
+    Py_END_ALLOW_THREADS
+
+    if (outOfMemory)
+        return PyErr_NoMemory();
+
+    if (invalidTrains)
+    {
+        PyErr_SetString(PyExc_ValueError, "spike times must be sorted in ascending order and must not be NaN");
+        return NULL;
+    }
+
+    PyObject *times = toNumPyArray(std::move(profileTimes));
+    if (times == NULL)
+        return NULL;
+
+    PyObject *values = toNumPyArray(std::move(profileValues));
+    if (values == NULL)
+    {
+        Py_DECREF(times);
+        return NULL;
+    }
+
+    PyObject *result = PyTuple_Pack(2, times, values);
+    Py_DECREF(times);
+    Py_DECREF(values);
+
+    return result;
+}
+
+// Compute the SYNC value of a float64 profile buffer. Return false (with the Python error set) on failure.
+static bool profileSYNCValue(PyObject *profile, double *syncValue)
+{
+    Py_buffer view;
+    if (!getTrainView(profile, &view, "d", 8, "float64"))
+        return false;
+
+    bool outOfMemory = false;
+
+    Py_BEGIN_ALLOW_THREADS
+    try
+    {
+        vector<double> coincidenceProfile;
+        readProfile((const char *) view.buf, view.shape[0], view.strides[0], coincidenceProfile);
+
+        SPIKESynchronization spike;
+        *syncValue = spike.SYNCValue(coincidenceProfile);
+    }
+    catch (const bad_alloc &)
+    {
+        outOfMemory = true;
+    }
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&view);
+
+    if (outOfMemory)
+    {
+        PyErr_NoMemory();
+        return false;
+    }
+
+    return true;
+}
+
+PyDoc_STRVAR(sync_value_doc,
+"sync_value(profile)\n"
+"\n"
+"Compute the SYNC value of a float64 SPIKE-Synchronization profile (the profile\n"
+"returned by profile() or the values returned by profile_time()).");
+
+static PyObject *spikesync_sync_value(PyObject *module, PyObject *profile)
+{
+    double syncValue;
+    if (!profileSYNCValue(profile, &syncValue))
+        return NULL;
+
+    return PyFloat_FromDouble(syncValue);
+}
+
+PyDoc_STRVAR(sync_distance_doc,
+"sync_distance(profile)\n"
+"\n"
+"Compute the SYNC distance (1 - SYNC value) of a float64 SPIKE-Synchronization profile.");
+
+static PyObject *spikesync_sync_distance(PyObject *module, PyObject *profile)
+{
+    double syncValue;
+    if (!profileSYNCValue(profile, &syncValue))
+        return NULL;
+
+    return PyFloat_FromDouble(1 - syncValue);
+}
+
+static PyMethodDef spikesync_methods[] =
+{
+    { "profile", (PyCFunction) spikesync_profile, METH_O, profile_doc },
+    { "profile_time", (PyCFunction) spikesync_profile_time, METH_O, profile_time_doc },
+    { "sync_value", (PyCFunction) spikesync_sync_value, METH_O, sync_value_doc },
+    { "sync_distance", (PyCFunction) spikesync_sync_distance, METH_O, sync_distance_doc },
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef spikesync_module =
+{
+    PyModuleDef_HEAD_INIT,
+    "spikesync",
+    "Python bindings for the C++ implementation of the SPIKE-Synchronization algorithm.",
+    -1,
+    spikesync_methods
+};
+
+PyMODINIT_FUNC PyInit_spikesync(void)
+{
+    ProfileBufferType.tp_name = "spikesync.ProfileBuffer";
+    ProfileBufferType.tp_doc = "Buffer owning a profile computed by the SPIKE-Synchronization engine.";
+    ProfileBufferType.tp_basicsize = sizeof(ProfileBufferObject);
+    ProfileBufferType.tp_flags = Py_TPFLAGS_DEFAULT;
+    ProfileBufferType.tp_dealloc = (destructor) ProfileBuffer_dealloc;
+    ProfileBufferType.tp_as_buffer = &ProfileBuffer_as_buffer;
+
+    if (PyType_Ready(&ProfileBufferType) < 0)
+        return NULL;
+
+    return PyModule_Create(&spikesync_module);
+}
+
+/*******************************************************************************************************************************/
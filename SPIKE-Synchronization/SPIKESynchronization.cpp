@@ -26,7 +26,7 @@ SPIKESynchronization::~SPIKESynchronization()
 /* Used only for vector inputs containing 1 where spikes occur, -1 otherwise.                                                  */
 /*******************************************************************************************************************************/
 
-int SPIKESynchronization::getPreviousSpikeIndex(vector<int> inputTrain, int index)
+int SPIKESynchronization::getPreviousSpikeIndex(const vector<int> &inputTrain, int index)
 {
     // Check the validity of the provided index.
     if (index < 1 || index >= inputTrain.size())
@@ -44,7 +44,7 @@ int SPIKESynchronization::getPreviousSpikeIndex(vector<int> inputTrain, int inde
     return -1;
 }
 
-int SPIKESynchronization::getNextSpikeIndex(vector<int> inputTrain, int index)
+int SPIKESynchronization::getNextSpikeIndex(const vector<int> &inputTrain, int index)
 {
     // Check the validity of the provided index.
     if (index < 0 || index >= inputTrain.size() - 1)
@@ -62,7 +62,7 @@ int SPIKESynchronization::getNextSpikeIndex(vector<int> inputTrain, int index)
     return -1;
 }
 
-double SPIKESynchronization::getTau(vector<int> inputTrain1, vector<int> inputTrain2, int index1, int index2)
+double SPIKESynchronization::getTau(const vector<int> &inputTrain1, const vector<int> &inputTrain2, int index1, int index2)
 {
     // A temporary vector to store the inter-spike intervals.
     vector<int> temp;
@@ -91,7 +91,7 @@ double SPIKESynchronization::getTau(vector<int> inputTrain1, vector<int> inputTr
     return 0.5 * (*min_element(begin(temp), end(temp)));
 }
 
-vector<int> SPIKESynchronization::CoincidenceVectorPair(vector<int> inputTrain1, vector<int> inputTrain2)
+vector<int> SPIKESynchronization::CoincidenceVectorPair(const vector<int> &inputTrain1, const vector<int> &inputTrain2)
 {
     // The spike trains in input can have different sizes,
     // and the coincidence train will have the same size
@@ -140,7 +140,7 @@ vector<int> SPIKESynchronization::CoincidenceVectorPair(vector<int> inputTrain1,
     return coincidenceVector;
 }
 
-vector<vector<double>> SPIKESynchronization::CoincidenceVectorMultivariate(vector<vector<int>> inputTrainsVector)
+vector<vector<double>> SPIKESynchronization::CoincidenceVectorMultivariate(const vector<vector<int>> &inputTrainsVector)
 {
     // Contains coincidence vectors for pairs of spike trains.
     vector<vector<vector<int>>> coincidenceVectorPairs;
@@ -214,7 +214,7 @@ vector<vector<double>> SPIKESynchronization::CoincidenceVectorMultivariate(vecto
     return coincidenceVectorMultivariate;
 }
 
-vector<double> SPIKESynchronization::MergeCoincidencesMultivariate(vector<vector<double>> coincidenceVectorsVector)
+vector<double> SPIKESynchronization::MergeCoincidencesMultivariate(const vector<vector<double>> &coincidenceVectorsVector)
 {
     int trainSize = 0;
 
@@ -240,7 +240,7 @@ vector<double> SPIKESynchronization::MergeCoincidencesMultivariate(vector<vector
     return mergedCoincidenceMultivariate;
 }
 
-double SPIKESynchronization::SYNCValue(vector<double> coincidenceProfile)
+double SPIKESynchronization::SYNCValue(const vector<double> &coincidenceProfile)
 {
     double syncValue = 0;
     double totalSpikes = 0;
@@ -264,7 +264,7 @@ double SPIKESynchronization::SYNCValue(vector<double> coincidenceProfile)
     return syncValue / totalSpikes;
 }
 
-double SPIKESynchronization::SYNCDistance(vector<double> coincidenceProfile)
+double SPIKESynchronization::SYNCDistance(const vector<double> &coincidenceProfile)
 {
     return 1 - SYNCValue(coincidenceProfile);
 }
@@ -277,7 +277,7 @@ double SPIKESynchronization::SYNCDistance(vector<double> coincidenceProfile)
 /* Used only for vector inputs containing the times at which the spikes occur.                                                 */
 /*******************************************************************************************************************************/
 
-int SPIKESynchronization::getPreviousSpikeIndex(vector<double> inputTrain, int index)
+int SPIKESynchronization::getPreviousSpikeIndex(const vector<double> &inputTrain, int index)
 {
     // Check the validity of the provided index.
     if (index < 1 || index >= inputTrain.size())
@@ -286,7 +286,7 @@ int SPIKESynchronization::getPreviousSpikeIndex(vector<double> inputTrain, int i
     return index - 1;
 }
 
-int SPIKESynchronization::getNextSpikeIndex(vector<double> inputTrain, int index)
+int SPIKESynchronization::getNextSpikeIndex(const vector<double> &inputTrain, int index)
 {
     // Check the validity of the provided index.
     if (index < 0 || index >= inputTrain.size() - 1)
@@ -295,7 +295,7 @@ int SPIKESynchronization::getNextSpikeIndex(vector<double> inputTrain, int index
     return index + 1;
 }
 
-double SPIKESynchronization::getTau(vector<double> inputTrain1, vector<double> inputTrain2, int index1, int index2)
+double SPIKESynchronization::getTau(const vector<double> &inputTrain1, const vector<double> &inputTrain2, int index1, int index2)
 {
     // A temporary vector to store the inter-spike intervals.
     vector<double> temp;
@@ -324,7 +324,7 @@ double SPIKESynchronization::getTau(vector<double> inputTrain1, vector<double> i
     return 0.5 * (*min_element(begin(temp), end(temp)));
 }
 
-map<double, int> SPIKESynchronization::CoincidenceVectorPair(vector<double> inputTrain1, vector<double> inputTrain2)
+map<double, int> SPIKESynchronization::CoincidenceVectorPair(const vector<double> &inputTrain1, const vector<double> &inputTrain2)
 {
     int trainSize1 = inputTrain1.size();
     int trainSize2 = inputTrain2.size();
@@ -371,7 +371,7 @@ map<double, int> SPIKESynchronization::CoincidenceVectorPair(vector<double> inpu
     return coincidenceVector;
 }
 
-vector<map<double, double>> SPIKESynchronization::CoincidenceVectorMultivariate(vector<vector<double>> inputTrainsTime)
+vector<map<double, double>> SPIKESynchronization::CoincidenceVectorMultivariate(const vector<vector<double>> &inputTrainsTime)
 {
     // Contains coincidence vectors for pairs of spike trains.
     vector<vector<map<double, int>>> coincidenceVectorPairs;
@@ -431,7 +431,7 @@ vector<map<double, double>> SPIKESynchronization::CoincidenceVectorMultivariate(
     return coincidenceVectorMultivariate;
 }
 
-map<double, double> SPIKESynchronization::MergeCoincidencesMultivariate(vector<map<double, double>> coincidenceVectorsTime)
+map<double, double> SPIKESynchronization::MergeCoincidencesMultivariate(const vector<map<double, double>> &coincidenceVectorsTime)
 {
     map<double, double> mergedCoincidenceMultivariate;
 
@@ -446,8 +446,8 @@ map<double, double> SPIKESynchronization::MergeCoincidencesMultivariate(vector<m
             if (coincidenceVectorsTime[j].count(timeSpikePair1.first) > 0)
             {
                 // Take the coincidence with the highest value.
-                if (coincidenceVectorsTime[j][timeSpikePair1.first] > timeSpikePair1.second)
-                    mergedCoincidenceMultivariate[timeSpikePair1.first] = coincidenceVectorsTime[j][timeSpikePair1.first];
+                if (coincidenceVectorsTime[j].at(timeSpikePair1.first) > timeSpikePair1.second)
+                    mergedCoincidenceMultivariate[timeSpikePair1.first] = coincidenceVectorsTime[j].at(timeSpikePair1.first);
             }
         }
     }
@@ -455,7 +455,7 @@ map<double, double> SPIKESynchronization::MergeCoincidencesMultivariate(vector<m
     return mergedCoincidenceMultivariate;
 }
 
-double SPIKESynchronization::SYNCValue(map<double, double> coincidenceProfile)
+double SPIKESynchronization::SYNCValue(const map<double, double> &coincidenceProfile)
 {
     double syncValue = 0;
     double totalSpikes = 0;
@@ -479,7 +479,7 @@ double SPIKESynchronization::SYNCValue(map<double, double> coincidenceProfile)
     return syncValue / totalSpikes;
 }
 
-double SPIKESynchronization::SYNCDistance(map<double, double> coincidenceProfile)
+double SPIKESynchronization::SYNCDistance(const map<double, double> &coincidenceProfile)
 {
     return 1 - SYNCValue(coincidenceProfile);
 }
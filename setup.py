@@ -0,0 +1,21 @@
+from setuptools import Extension, setup
+
+# Build the Python bindings with "pip install ." (NumPy is required at runtime only).
+setup(
+    name="spikesync",
+    version="1.0.0",
+    description="Python bindings for the C++ implementation of the SPIKE-Synchronization algorithm",
+    license="MIT",
+    install_requires=["numpy"],
+    ext_modules=[
+        Extension(
+            "spikesync",
+            sources=[
+                "SPIKE-Synchronization/PySPIKESynchronization.cpp",
+                "SPIKE-Synchronization/SPIKESynchronization.cpp",
+            ],
+            include_dirs=["SPIKE-Synchronization"],
+            language="c++",
+        )
+    ],
+)
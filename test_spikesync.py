@@ -0,0 +1,103 @@
+# Smoke test for the Python bindings. Run it with "python test_spikesync.py" after "pip install .".
+
+import numpy as np
+
+import spikesync
+
+# The sample spike trains of Main.cpp, as vectors (1 - spike, -1 - non-spike).
+INPUT_TRAINS_VECTOR = np.array(
+    [
+        [1, -1, -1, 1, -1, -1, 1, -1, -1, -1, 1, 1, -1, 1, -1, -1, 1],
+        [-1, 1, -1, -1, 1, -1, -1, 1, -1, -1, 1, -1, -1, -1, 1, 1, -1],
+        [1, 1, -1, -1, -1, 1, -1, 1, -1, -1, 1, -1, -1, 1, 1, 1, -1],
+    ],
+    dtype=np.int64,
+)
+EXPECTED_PROFILE_VECTOR = [1, 1, -1, 0.5, 0.5, 0, 0.5, 1, -1, -1, 1, 0, -1, 0.5, 0.5, 0.5, 0]
+
+# The sample spike trains of Main.cpp, as the times at which the spikes occur.
+INPUT_TRAINS_TIME = np.array(
+    [
+        [0.0, 1.0, 1.5, 3.0, 5.0, 6.5, 7.0, 7.5, 8.0, 10.0, 100.0],
+        [0.2, 0.4, 1.2, 3.1, 5.0, 6.5, 6.9, 7.9, 8.0, 11.0, 102.0],
+        [0.0, 1.0, 1.5, 3.0, 5.0, 6.5, 7.0, 7.5, 8.0, 10.0, 100.0],
+    ]
+)
+EXPECTED_TIMES = [0, 0.2, 0.4, 1, 1.2, 1.5, 3, 3.1, 5, 6.5, 6.9, 7, 7.5, 7.9, 8, 10, 11, 100, 102]
+EXPECTED_VALUES = [0.5, 0, 0, 1, 1, 0.5, 1, 1, 1, 1, 1, 1, 0.5, 0, 1, 0.5, 0, 1, 1]
+
+
+def assert_raises(exception, function, *args):
+    try:
+        function(*args)
+    except exception:
+        return
+    raise AssertionError("{0} not raised by {1}{2}".format(exception.__name__, function.__name__, args))
+
+
+def test_profile():
+    profile = spikesync.profile(INPUT_TRAINS_VECTOR)
+    assert profile.dtype == np.float64
+    assert np.array_equal(profile, EXPECTED_PROFILE_VECTOR)
+    assert np.isclose(spikesync.sync_value(profile), 7 / 13)
+    assert np.isclose(spikesync.sync_distance(profile), 6 / 13)
+
+    # Every input form must give the same result.
+    assert np.array_equal(spikesync.profile(list(INPUT_TRAINS_VECTOR)), profile)
+    assert np.array_equal(spikesync.profile(np.asfortranarray(INPUT_TRAINS_VECTOR)), profile)
+    assert np.array_equal(
+        spikesync.profile(INPUT_TRAINS_VECTOR[:, ::2]),
+        spikesync.profile(np.ascontiguousarray(INPUT_TRAINS_VECTOR[:, ::2])),
+    )
+
+    # Values outside the range of int must not be mistaken for spikes.
+    wrapped = spikesync.profile(np.array([[1, -1, 2**32 + 1, -1], [-1, 1, -1, -1]], dtype=np.int64))
+    assert np.array_equal(wrapped, [0, 0, -1, -1])
+
+
+def test_profile_time():
+    times, values = spikesync.profile_time(INPUT_TRAINS_TIME)
+    assert np.allclose(times, EXPECTED_TIMES)
+    assert np.allclose(values, EXPECTED_VALUES)
+    assert np.isclose(spikesync.sync_value(values), 13 / 19)
+
+    for trains in (list(INPUT_TRAINS_TIME), np.asfortranarray(INPUT_TRAINS_TIME)):
+        other_times, other_values = spikesync.profile_time(trains)
+        assert np.array_equal(other_times, times)
+        assert np.array_equal(other_values, values)
+
+    strided_times, strided_values = spikesync.profile_time(INPUT_TRAINS_TIME[:, ::2])
+    contiguous_times, contiguous_values = spikesync.profile_time(np.ascontiguousarray(INPUT_TRAINS_TIME[:, ::2]))
+    assert np.array_equal(strided_times, contiguous_times)
+    assert np.array_equal(strided_values, contiguous_values)
+
+
+def test_errors():
+    # Fewer than two spike trains.
+    assert_raises(ValueError, spikesync.profile, INPUT_TRAINS_VECTOR[:1])
+    assert_raises(ValueError, spikesync.profile, [INPUT_TRAINS_VECTOR[0]])
+    assert_raises(ValueError, spikesync.profile_time, INPUT_TRAINS_TIME[:1])
+
+    # Wrong dtype.
+    assert_raises(TypeError, spikesync.profile, INPUT_TRAINS_VECTOR.astype(np.int32))
+    assert_raises(TypeError, spikesync.profile, INPUT_TRAINS_TIME)
+    assert_raises(TypeError, spikesync.profile_time, INPUT_TRAINS_VECTOR)
+    assert_raises(TypeError, spikesync.sync_value, INPUT_TRAINS_VECTOR[0])
+
+    # Wrong number of dimensions, or not buffers at all.
+    assert_raises(TypeError, spikesync.profile, INPUT_TRAINS_VECTOR[0])
+    assert_raises(TypeError, spikesync.profile, INPUT_TRAINS_VECTOR[np.newaxis])
+    assert_raises(TypeError, spikesync.profile, [1, 2])
+    assert_raises(TypeError, spikesync.profile, 5)
+    assert_raises(TypeError, spikesync.sync_value, np.zeros((2, 2)))
+
+    # NaN or unsorted spike times.
+    assert_raises(ValueError, spikesync.profile_time, np.array([[0.0, 1.0, np.nan], [0.5, np.nan, np.nan]]))
+    assert_raises(ValueError, spikesync.profile_time, [np.array([3.0, 1.0, 2.0]), np.array([2.5, 0.0])])
+
+
+if __name__ == "__main__":
+    test_profile()
+    test_profile_time()
+    test_errors()
+    print("All spikesync tests passed.")